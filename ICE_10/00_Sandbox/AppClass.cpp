@@ -10,6 +10,7 @@ void AppClass::InitApplication(String a_sWindowName)
 }
 void AppClass::InitUserVariables(void)
 {
+	m_pInfiniteGrid = new MyGrid();
 }
 
 void AppClass::Update(void)
@@ -23,14 +24,15 @@ void AppClass::Display(void)
 {
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); // clear the window
 
-	m_pGrid->Render(); //renders the XY grid with a 100% scale
-
 	m_pMeshMngr->Render();
 
+	m_pInfiniteGrid->Render(); //renders the XY grid with one unit between lines, after the scene so it blends over it
+
 	m_pGLSystem->GLSwapBuffers(); //Swaps the OpenGL buffers
 }
 
 void AppClass::Release(void)
 {
+	SafeDelete(m_pInfiniteGrid);
 	super::Release();
 }
\ No newline at end of file
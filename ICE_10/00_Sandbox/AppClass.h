@@ -6,6 +6,7 @@ Date: 2015/09
 #define __APPLICATION_H_
 
 #include "RE\ReEngAppClass.h"
+#include "MyGrid.h"
 #include <SFML\Graphics.hpp>
 //#include <chrono>
 
@@ -16,6 +17,8 @@ class AppClass : public ReEngAppClass
 public:
 	typedef ReEngAppClass super;
 
+	MyGrid* m_pInfiniteGrid = nullptr; //Shader only grid, replaces m_pGrid
+
 	/* Constructor */
 	AppClass(HINSTANCE hInstance, LPWSTR lpCmdLine, int nCmdShow) : super(hInstance, lpCmdLine, nCmdShow) {}
 
@@ -0,0 +1,97 @@
+#include "MyGrid.h"
+//  MyGrid
+void MyGrid::Init(void)
+{
+	m_pCamera = CameraSingleton::GetInstance();
+	ShaderManagerSingleton* pShaderMngr = ShaderManagerSingleton::GetInstance();
+	FolderSingleton* pFolder = FolderSingleton::GetInstance();
+
+	//Compile Grid shader
+	if (pShaderMngr->IdentifyShader("Grid") < 0)
+		pShaderMngr->CompileShader(pFolder->GetFolderShaders() + "Grid.vs", pFolder->GetFolderShaders() + "Grid.fs", "Grid");
+
+	//The program and its uniform locations do not change, ask for them once
+	m_nProgram = pShaderMngr->GetShaderID("Grid");
+	m_InverseVP = glGetUniformLocation(m_nProgram, "m4InverseVP");
+	m_VP = glGetUniformLocation(m_nProgram, "VP");
+	m_CameraPosition = glGetUniformLocation(m_nProgram, "CameraPosition");
+	m_Plane = glGetUniformLocation(m_nProgram, "nPlane");
+	m_Scale = glGetUniformLocation(m_nProgram, "fScale");
+	m_FadeDistance = glGetUniformLocation(m_nProgram, "fFadeDistance");
+
+	//The shader builds the triangle out of gl_VertexID, the VAO has no attributes
+	glGenVertexArrays(1, &m_vao);
+}
+void MyGrid::Release(void)
+{
+	m_pCamera = nullptr;
+
+	if (m_vao > 0)
+		glDeleteVertexArrays(1, &m_vao);
+	m_vao = 0;
+}
+//The big 3
+MyGrid::MyGrid(float a_fFadeDistance)
+{
+	m_fFadeDistance = a_fFadeDistance;
+	Init();
+}
+MyGrid::MyGrid(MyGrid const& other)
+{
+	m_fFadeDistance = other.m_fFadeDistance;
+	Init();
+}
+MyGrid& MyGrid::operator=(MyGrid const& other)
+{
+	if (this != &other)
+		m_fFadeDistance = other.m_fFadeDistance;
+	return *this;
+}
+MyGrid::~MyGrid(){ Release(); };
+//Methods
+void MyGrid::Render(float a_fSpacing, int a_Axis)
+{
+	if (a_Axis == REAXIS::NONE)
+		return;
+
+	glUseProgram(m_nProgram);
+
+	vector3 v3CameraPosition = m_pCamera->GetPosition();
+	glUniformMatrix4fv(m_InverseVP, 1, GL_FALSE, glm::value_ptr(m_pCamera->GetInverseVP()));
+	glUniformMatrix4fv(m_VP, 1, GL_FALSE, glm::value_ptr(m_pCamera->GetVP()));
+	glUniform3f(m_CameraPosition, v3CameraPosition.x, v3CameraPosition.y, v3CameraPosition.z);
+	glUniform1f(m_Scale, a_fSpacing);
+	glUniform1f(m_FadeDistance, m_fFadeDistance);
+
+	//Blend the faded lines over the scene, test against its depth but do not write to it
+	//Save the state this changes so the draws after the grid are not affected
+	GLboolean bBlend = glIsEnabled(GL_BLEND);
+	GLboolean bDepthMask = GL_TRUE;
+	glGetBooleanv(GL_DEPTH_WRITEMASK, &bDepthMask);
+	GLint nBlendSrcRGB = 0, nBlendDstRGB = 0, nBlendSrcAlpha = 0, nBlendDstAlpha = 0;
+	glGetIntegerv(GL_BLEND_SRC_RGB, &nBlendSrcRGB);
+	glGetIntegerv(GL_BLEND_DST_RGB, &nBlendDstRGB);
+	glGetIntegerv(GL_BLEND_SRC_ALPHA, &nBlendSrcAlpha);
+	glGetIntegerv(GL_BLEND_DST_ALPHA, &nBlendDstAlpha);
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	glDepthMask(GL_FALSE);
+
+	//One full screen pass per plane in the mask, the shader numbers them 0 = XY, 1 = XZ, 2 = YZ
+	int lAxis[3] = { REAXIS::XY, REAXIS::XZ, REAXIS::YZ };
+	glBindVertexArray(m_vao);
+	for (int nPlane = 0; nPlane < 3; nPlane++)
+	{
+		if ((a_Axis & lAxis[nPlane]) == 0)
+			continue;
+
+		glUniform1i(m_Plane, nPlane);
+		glDrawArrays(GL_TRIANGLES, 0, 3);
+	}
+	glBindVertexArray(0);
+
+	glDepthMask(bDepthMask);
+	glBlendFuncSeparate(nBlendSrcRGB, nBlendDstRGB, nBlendSrcAlpha, nBlendDstAlpha);
+	if (!bBlend)
+		glDisable(GL_BLEND);
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+/*----------------------------------------------
+Date: 2026/10
+Notes: Grid drawn entirely by the Grid shader on a
+full screen triangle, it has no vertex data so its
+cost does not depend on its extent. Use it in place
+of GridClass for large scenes.
+----------------------------------------------*/
+#ifndef __MYGRID_H_
+#define __MYGRID_H_
+
+#include "RE\System\SystemSingleton.h"
+#include "RE\System\FolderSingleton.h"
+#include "RE\Camera\CameraSingleton.h"
+#include "RE\System\ShaderManagerSingleton.h"
+
+using namespace ReEng;
+//System Class
+class MyGrid
+{
+	float m_fFadeDistance = 100.0f; //Distance from the camera at which the grid disappears
+
+	GLuint m_vao = 0; //OpenGL Vertex Array Object, empty but required to draw
+	GLuint m_nProgram = 0; //OpenGL identifier of the Grid shader program
+
+	GLuint m_InverseVP = 0; //Location of the m4InverseVP uniform in the shader
+	GLuint m_VP = 0; //Location of the VP uniform in the shader
+	GLuint m_CameraPosition = 0; //Location of the CameraPosition uniform in the shader
+	GLuint m_Plane = 0; //Location of the nPlane uniform in the shader
+	GLuint m_Scale = 0; //Location of the fScale uniform in the shader
+	GLuint m_FadeDistance = 0; //Location of the fFadeDistance uniform in the shader
+
+	CameraSingleton* m_pCamera = nullptr; //Pointer to the singleton of CameraSingleton
+
+public:
+	/* Constructor */
+	MyGrid(float a_fFadeDistance = 100.0f);
+	/* Copy Constructor */
+	MyGrid(MyGrid const& other);
+	/* Copy Assignment Operator*/
+	MyGrid& operator=(MyGrid const& other);
+	/* Destructor */
+	~MyGrid(void);
+
+	/* Renders the Grid with the specified distance between lines, unlike GridClass the extent is not scaled, on every plane set in the mask (REAXIS::XY | REAXIS::XZ | REAXIS::YZ) */
+	void Render(float a_fSpacing = 1.0f, int a_Axis = REAXIS::XY);
+
+private:
+	/* Initialize the object's fields */
+	void Init(void);
+	/* Releases the object from memory */
+	void Release(void);
+};
+
+#endif //__MYGRID_H_
\ No newline at end of file
@@ -20,6 +20,10 @@ void AppClass::InitUserVariables(void)
 	
 	m_pMesh->CompileOpenGL3X();
 
+	//Report how the index optimization changed the vertex cache use
+	vector2 v2ACMR = m_pMesh->GetACMR();
+	printf("ACMR: %.3f original, %.3f optimized\n", v2ACMR.x, v2ACMR.y);
+
 }
 
 void AppClass::Update(void)
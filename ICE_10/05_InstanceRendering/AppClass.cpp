@@ -18,8 +18,20 @@ void AppClass::InitUserVariables(void)
 	m_pMesh->AddVertexColor(RERED);
 	m_pMesh->AddVertexColor(REBLUE);
 
+	//Every instance reads this mesh, upload it with the compressed layout
+	m_pMesh->SetCompressed(true);
 	m_pMesh->CompileOpenGL3X();
 
+	//Report how the index optimization changed the vertex cache use
+	vector2 v2ACMR = m_pMesh->GetACMR();
+	printf("ACMR: %.3f original, %.3f optimized\n", v2ACMR.x, v2ACMR.y);
+
+	//Report the memory the compressed layout saves per vertex and for the whole model
+	vector2 v2VertexBytes = m_pMesh->GetVertexBytes();
+	int nUploaded = m_pMesh->GetUploadedTotal();
+	printf("Vertex size: %.0f bytes as floats, %.0f bytes uploaded\n", v2VertexBytes.x, v2VertexBytes.y);
+	printf("Model size: %d vertices, %.0f bytes as floats, %.0f bytes uploaded\n", nUploaded, nUploaded * v2VertexBytes.x, nUploaded * v2VertexBytes.y);
+
 	m_fMatrixArray = new float[m_nObjects * 16];
 	//left diagnol
 	for (int nObject = 0; nObject < 4; nObject++)
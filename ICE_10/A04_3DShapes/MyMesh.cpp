@@ -4,29 +4,70 @@ void MyMesh::Init(void)
 {
 	m_bBinded = false;
 	m_nVertexCount = 0;
+	m_nUploadedCount = 0;
 
 	m_vao = 0;
 	m_VertexBuffer = 0;
 	m_ColorBuffer = 0;
+	m_IndexBuffer = 0;
+
+	m_v2ACMR = vector2(0.0f);
+	m_v2VertexBytes = vector2(0.0f);
+
+	m_v3QuantOffset = vector3(0.0f);
+	m_v3QuantScale = vector3(0.0f);
 
 	m_pCamera = CameraSingleton::GetInstance();;
 	m_pShaderMngr = ShaderManagerSingleton::GetInstance();
+
+	LoadProgram();
+}
+void MyMesh::LoadProgram(void)
+{
 	FolderSingleton* pFolder = FolderSingleton::GetInstance();
 
-	//Compile Color shader
-	m_pShaderMngr->CompileShader(pFolder->GetFolderShaders() + "BasicColor.vs", pFolder->GetFolderShaders() + "BasicColor.fs", "BasicColor");
+	//Compile the shader only if no other mesh has registered it already
+	//Both layouts share the fragment shader, the compressed one decodes the position in BasicColorQ.vs
+	String sName = m_bCompressed ? "BasicColorQ" : "BasicColor";
+	if (m_pShaderMngr->IdentifyShader(sName) < 0)
+		m_pShaderMngr->CompileShader(pFolder->GetFolderShaders() + sName + ".vs", pFolder->GetFolderShaders() + "BasicColor.fs", sName);
+
+	//The program and its uniform locations do not change, ask for them once
+	m_nProgram = m_pShaderMngr->GetShaderID(sName);
+	m_MVP = glGetUniformLocation(m_nProgram, "MVP");
+	m_Elements = glGetUniformLocation(m_nProgram, "nElements");
+	m_ToWorld = glGetUniformLocation(m_nProgram, "m4ToWorld");
+	m_QuantOffset = glGetUniformLocation(m_nProgram, "v3QuantOffset");
+	m_QuantScale = glGetUniformLocation(m_nProgram, "v3QuantScale");
 }
 void MyMesh::Swap(MyMesh& other)
 {
 	std::swap(m_bBinded, other.m_bBinded);
+	std::swap(m_bCompressed, other.m_bCompressed);
 	std::swap(m_nVertexCount, other.m_nVertexCount);
+	std::swap(m_nUploadedCount, other.m_nUploadedCount);
 
 	std::swap(m_vao, other.m_vao);
 	std::swap(m_VertexBuffer, other.m_VertexBuffer);
 	std::swap(m_ColorBuffer, other.m_ColorBuffer);
+	std::swap(m_IndexBuffer, other.m_IndexBuffer);
+
+	std::swap(m_nProgram, other.m_nProgram);
+	std::swap(m_MVP, other.m_MVP);
+	std::swap(m_Elements, other.m_Elements);
+	std::swap(m_ToWorld, other.m_ToWorld);
+	std::swap(m_QuantOffset, other.m_QuantOffset);
+	std::swap(m_QuantScale, other.m_QuantScale);
 
 	std::swap(m_lVertexPos, other.m_lVertexPos);
 	std::swap(m_lVertexCol, other.m_lVertexCol);
+	std::swap(m_lIndex, other.m_lIndex);
+
+	std::swap(m_v2ACMR, other.m_v2ACMR);
+	std::swap(m_v2VertexBytes, other.m_v2VertexBytes);
+
+	std::swap(m_v3QuantOffset, other.m_v3QuantOffset);
+	std::swap(m_v3QuantScale, other.m_v3QuantScale);
 
 	std::swap(m_pCamera, other.m_pCamera);
 	std::swap(m_pShaderMngr, other.m_pShaderMngr);
@@ -36,6 +77,9 @@ void MyMesh::Release(void)
 	m_pCamera = nullptr;
 	m_pShaderMngr = nullptr;
 
+	if (m_IndexBuffer > 0)
+		glDeleteBuffers(1, &m_IndexBuffer);
+
 	if (m_ColorBuffer > 0)
 		glDeleteBuffers(1, &m_ColorBuffer);
 
@@ -47,20 +91,38 @@ void MyMesh::Release(void)
 
 	m_lVertexPos.clear();
 	m_lVertexCol.clear();
+	m_lIndex.clear();
 }
 //The big 3
 MyMesh::MyMesh(){ Init(); }
 MyMesh::MyMesh(MyMesh const& other)
 {
 	m_bBinded = other.m_bBinded;
+	m_bCompressed = other.m_bCompressed;
 	m_nVertexCount = other.m_nVertexCount;
+	m_nUploadedCount = other.m_nUploadedCount;
 
 	m_vao = other.m_vao;
 	m_VertexBuffer = other.m_VertexBuffer;
 	m_ColorBuffer = other.m_ColorBuffer;
+	m_IndexBuffer = other.m_IndexBuffer;
+
+	m_nProgram = other.m_nProgram;
+	m_MVP = other.m_MVP;
+	m_Elements = other.m_Elements;
+	m_ToWorld = other.m_ToWorld;
+	m_QuantOffset = other.m_QuantOffset;
+	m_QuantScale = other.m_QuantScale;
 
 	m_lVertexPos = other.m_lVertexPos;
 	m_lVertexCol = other.m_lVertexCol;
+	m_lIndex = other.m_lIndex;
+
+	m_v2ACMR = other.m_v2ACMR;
+	m_v2VertexBytes = other.m_v2VertexBytes;
+
+	m_v3QuantOffset = other.m_v3QuantOffset;
+	m_v3QuantScale = other.m_v3QuantScale;
 
 	m_pCamera = other.m_pCamera;
 	m_pShaderMngr = other.m_pShaderMngr;
@@ -79,6 +141,18 @@ MyMesh& MyMesh::operator=(MyMesh const& other)
 MyMesh::~MyMesh(){ Release(); };
 //Accessors
 int MyMesh::GetVertexTotal(void){ return m_nVertexCount; }
+vector2 MyMesh::GetACMR(void){ return m_v2ACMR; }
+int MyMesh::GetUploadedTotal(void){ return m_nUploadedCount; }
+vector2 MyMesh::GetVertexBytes(void){ return m_v2VertexBytes; }
+void MyMesh::SetCompressed(bool a_bCompressed)
+{
+	//The layout is fixed once the buffers are uploaded
+	if (m_bBinded)
+		return;
+
+	m_bCompressed = a_bCompressed;
+	LoadProgram();
+}
 void MyMesh::AddVertexPosition(vector3 input){ m_lVertexPos.push_back(input); m_nVertexCount++; }
 void MyMesh::AddVertexColor(vector3 input){ m_lVertexCol.push_back(input); }
 //Methods
@@ -88,16 +162,207 @@ void MyMesh::CompleteMesh(void)
 	for (int nColor = nColorTotal; nColor < m_nVertexCount; nColor++)
 		m_lVertexCol.push_back(vector3(1.0f, 0.0f, 1.0f));
 }
+void MyMesh::IndexMesh(std::vector<vector3>& a_lPosition, std::vector<vector3>& a_lColor)
+{
+	//Only whole triangles are drawn
+	int nVertices = (m_nVertexCount / 3) * 3;
+
+	//Sort the vertices so the ones with the same position and color end up next to each other
+	std::vector<int> lOrder(nVertices);
+	for (int nVertex = 0; nVertex < nVertices; nVertex++)
+		lOrder[nVertex] = nVertex;
+	std::sort(lOrder.begin(), lOrder.end(), [this](int a_nA, int a_nB)
+	{
+		for (int nAxis = 0; nAxis < 3; nAxis++)
+		{
+			if (m_lVertexPos[a_nA][nAxis] != m_lVertexPos[a_nB][nAxis])
+				return m_lVertexPos[a_nA][nAxis] < m_lVertexPos[a_nB][nAxis];
+		}
+		for (int nChannel = 0; nChannel < 3; nChannel++)
+		{
+			if (m_lVertexCol[a_nA][nChannel] != m_lVertexCol[a_nB][nChannel])
+				return m_lVertexCol[a_nA][nChannel] < m_lVertexCol[a_nB][nChannel];
+		}
+		return false;
+	});
+
+	//Weld, every run of equal vertices gets the same index
+	int nUnique = 0;
+	std::vector<int> lSource; //one original vertex for each welded index
+	m_lIndex.resize(nVertices);
+	for (int nSorted = 0; nSorted < nVertices; nSorted++)
+	{
+		int nVertex = lOrder[nSorted];
+		if (nSorted > 0)
+		{
+			int nPrevious = lOrder[nSorted - 1];
+			if (m_lVertexPos[nVertex] != m_lVertexPos[nPrevious] || m_lVertexCol[nVertex] != m_lVertexCol[nPrevious])
+				nUnique++;
+		}
+		if (static_cast<int>(lSource.size()) == nUnique)
+			lSource.push_back(nVertex);
+		m_lIndex[nVertex] = nUnique;
+	}
+	nUnique = static_cast<int>(lSource.size());
+
+	//Reorder the triangles for the vertex cache
+	m_v2ACMR.x = CalculateACMR();
+	OptimizeVertexCache(nUnique);
+	m_v2ACMR.y = CalculateACMR();
+
+	//Renumber the vertices in the order the indices first use them so they are fetched sequentially
+	std::vector<int> lRemap(nUnique, -1);
+	a_lPosition.clear();
+	a_lColor.clear();
+	a_lPosition.reserve(nUnique);
+	a_lColor.reserve(nUnique);
+	for (uint nIndex = 0; nIndex < m_lIndex.size(); nIndex++)
+	{
+		GLuint nWelded = m_lIndex[nIndex];
+		if (lRemap[nWelded] < 0)
+		{
+			lRemap[nWelded] = static_cast<int>(a_lPosition.size());
+			a_lPosition.push_back(m_lVertexPos[lSource[nWelded]]);
+			a_lColor.push_back(m_lVertexCol[lSource[nWelded]]);
+		}
+		m_lIndex[nIndex] = lRemap[nWelded];
+	}
+}
+void MyMesh::OptimizeVertexCache(int a_nVertices)
+{
+	//Nothing to reorder, and the fan below needs at least one vertex to start from
+	if (a_nVertices == 0 || m_lIndex.empty())
+		return;
+
+	int nTriangles = static_cast<int>(m_lIndex.size()) / 3;
+
+	//Number of triangles not yet emitted that use each vertex
+	std::vector<int> lLive(a_nVertices, 0);
+	for (uint nIndex = 0; nIndex < m_lIndex.size(); nIndex++)
+		lLive[m_lIndex[nIndex]]++;
+
+	//Triangles that use each vertex, the ones of vertex v go from lOffset[v] to lOffset[v + 1]
+	std::vector<int> lOffset(a_nVertices + 1, 0);
+	for (int nVertex = 0; nVertex < a_nVertices; nVertex++)
+		lOffset[nVertex + 1] = lOffset[nVertex] + lLive[nVertex];
+	std::vector<int> lAdjacency(m_lIndex.size());
+	std::vector<int> lFill(lOffset.begin(), lOffset.end() - 1);
+	for (int nTriangle = 0; nTriangle < nTriangles; nTriangle++)
+	{
+		for (int nCorner = 0; nCorner < 3; nCorner++)
+			lAdjacency[lFill[m_lIndex[nTriangle * 3 + nCorner]]++] = nTriangle;
+	}
+
+	std::vector<int> lCacheTime(a_nVertices, 0);
+	std::vector<bool> lEmitted(nTriangles, false);
+	std::vector<int> lDeadEnd; //recently used vertices, to restart from when a fan runs out of candidates
+	std::vector<GLuint> lOutput;
+	lOutput.reserve(m_lIndex.size());
+
+	int nFanning = 0;
+	int nTime = m_nCacheSize + 1;
+	int nCursor = 1;
+	while (nFanning >= 0)
+	{
+		//Emit every remaining triangle around the fanning vertex
+		std::vector<int> lCandidate;
+		for (int nAdjacent = lOffset[nFanning]; nAdjacent < lOffset[nFanning + 1]; nAdjacent++)
+		{
+			int nTriangle = lAdjacency[nAdjacent];
+			if (lEmitted[nTriangle])
+				continue;
+			for (int nCorner = 0; nCorner < 3; nCorner++)
+			{
+				int nVertex = m_lIndex[nTriangle * 3 + nCorner];
+				lOutput.push_back(nVertex);
+				lDeadEnd.push_back(nVertex);
+				lCandidate.push_back(nVertex);
+				lLive[nVertex]--;
+				if (nTime - lCacheTime[nVertex] > m_nCacheSize)
+				{
+					lCacheTime[nVertex] = nTime;
+					nTime++;
+				}
+			}
+			lEmitted[nTriangle] = true;
+		}
+
+		//Next fan around the candidate that will still be in the cache after its triangles are emitted
+		nFanning = -1;
+		int nBestPriority = -1;
+		for (uint nCandidate = 0; nCandidate < lCandidate.size(); nCandidate++)
+		{
+			int nVertex = lCandidate[nCandidate];
+			if (lLive[nVertex] <= 0)
+				continue;
+			int nPriority = 0;
+			if (nTime - lCacheTime[nVertex] + 2 * lLive[nVertex] <= m_nCacheSize)
+				nPriority = nTime - lCacheTime[nVertex];
+			if (nPriority > nBestPriority)
+			{
+				nBestPriority = nPriority;
+				nFanning = nVertex;
+			}
+		}
+
+		//Dead end, go back to the most recently used vertex with triangles left
+		while (nFanning < 0 && !lDeadEnd.empty())
+		{
+			int nVertex = lDeadEnd.back();
+			lDeadEnd.pop_back();
+			if (lLive[nVertex] > 0)
+				nFanning = nVertex;
+		}
+
+		//Nothing recent left, go on with the next vertex in order
+		while (nFanning < 0 && nCursor < a_nVertices)
+		{
+			if (lLive[nCursor] > 0)
+				nFanning = nCursor;
+			nCursor++;
+		}
+	}
+
+	m_lIndex = lOutput;
+}
+float MyMesh::CalculateACMR(void)
+{
+	int nTriangles = static_cast<int>(m_lIndex.size()) / 3;
+	if (nTriangles == 0)
+		return 0.0f;
+
+	//Simulate a FIFO cache and count the vertices that are not in it when requested
+	std::vector<GLuint> lCache;
+	int nMisses = 0;
+	for (uint nIndex = 0; nIndex < m_lIndex.size(); nIndex++)
+	{
+		if (std::find(lCache.begin(), lCache.end(), m_lIndex[nIndex]) != lCache.end())
+			continue;
+		nMisses++;
+		lCache.push_back(m_lIndex[nIndex]);
+		if (static_cast<int>(lCache.size()) > m_nCacheSize)
+			lCache.erase(lCache.begin());
+	}
+	return static_cast<float>(nMisses) / nTriangles;
+}
 void MyMesh::CompileOpenGL3X(void)
 {
 	if (m_bBinded)
 		return;
 
-	if (m_nVertexCount == 0)
+	//Less than a whole triangle, nothing to draw
+	if (m_nVertexCount < 3)
 		return;
 
 	CompleteMesh();
 
+	//Weld the vertices and optimize the triangle order
+	std::vector<vector3> lPosition;
+	std::vector<vector3> lColor;
+	IndexMesh(lPosition, lColor);
+	if (m_lIndex.empty())
+		return;
+
 	// Create a vertex array object
 	glGenVertexArrays(1, &m_vao);
 	glBindVertexArray(m_vao);
@@ -105,12 +370,87 @@ void MyMesh::CompileOpenGL3X(void)
 	// Create and initialize a buffer object for each shape.
 	glGenBuffers(1, &m_VertexBuffer);
 	glBindBuffer(GL_ARRAY_BUFFER, m_VertexBuffer);
-	glBufferData(GL_ARRAY_BUFFER, m_nVertexCount * sizeof(vector3), &m_lVertexPos[0], GL_STATIC_DRAW);
+	if (m_bCompressed)
+	{
+		//Positions are quantized to 16 bits inside the mesh AABB, BasicColorQ.vs maps them back with its offset and scale
+		vector3 v3Min = lPosition[0];
+		vector3 v3Max = lPosition[0];
+		for (uint nVertex = 1; nVertex < lPosition.size(); nVertex++)
+		{
+			v3Min = glm::min(v3Min, lPosition[nVertex]);
+			v3Max = glm::max(v3Max, lPosition[nVertex]);
+		}
+		m_v3QuantOffset = v3Min;
+		m_v3QuantScale = v3Max - v3Min;
+
+		//Four components keep every vertex 4 byte aligned, the last one is not read
+		std::vector<GLushort> lPositionShort(lPosition.size() * 4, 0);
+		for (uint nVertex = 0; nVertex < lPosition.size(); nVertex++)
+		{
+			for (int nAxis = 0; nAxis < 3; nAxis++)
+			{
+				float fValue = 0.0f;
+				if (m_v3QuantScale[nAxis] > 0.0f)
+					fValue = (lPosition[nVertex][nAxis] - v3Min[nAxis]) / m_v3QuantScale[nAxis];
+				lPositionShort[nVertex * 4 + nAxis] = static_cast<GLushort>(glm::clamp(fValue, 0.0f, 1.0f) * 65535.0f + 0.5f);
+			}
+		}
+		glBufferData(GL_ARRAY_BUFFER, lPositionShort.size() * sizeof(GLushort), &lPositionShort[0], GL_STATIC_DRAW);
+	}
+	else
+		glBufferData(GL_ARRAY_BUFFER, lPosition.size() * sizeof(vector3), &lPosition[0], GL_STATIC_DRAW);
 
 	//Initialize the color buffer for the object.
 	glGenBuffers(1, &m_ColorBuffer);
 	glBindBuffer(GL_ARRAY_BUFFER, m_ColorBuffer);
-	glBufferData(GL_ARRAY_BUFFER, m_nVertexCount * sizeof(vector3), &m_lVertexCol[0], GL_STATIC_DRAW);
+	if (m_bCompressed)
+	{
+		//Colors are stored as normalized bytes, the GPU expands them back to floats
+		std::vector<GLubyte> lColorByte(lColor.size() * 4);
+		for (uint nVertex = 0; nVertex < lColor.size(); nVertex++)
+		{
+			for (int nChannel = 0; nChannel < 3; nChannel++)
+				lColorByte[nVertex * 4 + nChannel] = static_cast<GLubyte>(glm::clamp(lColor[nVertex][nChannel], 0.0f, 1.0f) * 255.0f + 0.5f);
+			lColorByte[nVertex * 4 + 3] = 255;
+		}
+		glBufferData(GL_ARRAY_BUFFER, lColorByte.size() * sizeof(GLubyte), &lColorByte[0], GL_STATIC_DRAW);
+	}
+	else
+		glBufferData(GL_ARRAY_BUFFER, lColor.size() * sizeof(vector3), &lColor[0], GL_STATIC_DRAW);
+
+	//Memory used per vertex, float layout against the uploaded one
+	m_nUploadedCount = static_cast<int>(lPosition.size());
+	m_v2VertexBytes.x = static_cast<float>(2 * sizeof(vector3));
+	m_v2VertexBytes.y = m_v2VertexBytes.x;
+	if (m_bCompressed)
+		m_v2VertexBytes.y = static_cast<float>(4 * sizeof(GLushort) + 4 * sizeof(GLubyte));
+
+	//Initialize the index buffer, its binding is kept by the VAO
+	glGenBuffers(1, &m_IndexBuffer);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBuffer);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_lIndex.size() * sizeof(GLuint), &m_lIndex[0], GL_STATIC_DRAW);
+
+	//Record the vertex layout in the VAO so drawing only needs to bind it
+	GLuint v4Position = glGetAttribLocation(m_nProgram, "Position_b");
+	GLuint v4Color = glGetAttribLocation(m_nProgram, "Color_b");
+
+	//position
+	glEnableVertexAttribArray(v4Position);
+	glBindBuffer(GL_ARRAY_BUFFER, m_VertexBuffer);
+	if (m_bCompressed)
+		glVertexAttribPointer(v4Position, 4, GL_UNSIGNED_SHORT, GL_TRUE, 0, (void*)0);
+	else
+		glVertexAttribPointer(v4Position, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
+
+	//Color
+	glEnableVertexAttribArray(v4Color);
+	glBindBuffer(GL_ARRAY_BUFFER, m_ColorBuffer);
+	if (m_bCompressed)
+		glVertexAttribPointer(v4Color, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, (void*)0);
+	else
+		glVertexAttribPointer(v4Color, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
+
+	glBindVertexArray(0);
 
 	m_bBinded = true;
 
@@ -122,47 +462,36 @@ void MyMesh::RenderList(float* a_fMatrixArray, int a_nInstances)
 		return;
 
 	// Use the buffer and shader
-	GLuint nProgram = m_pShaderMngr->GetShaderID("BasicColor");
-	glUseProgram(nProgram);
-
-	// Get the GPU variables by their name and hook them to CPU variables
-	GLuint MVP = glGetUniformLocation(nProgram, "MVP");
-	GLuint m4ModelToWorld = glGetUniformLocation(nProgram, "m4ModelToWorld");
-
-	GLuint v4Position = glGetAttribLocation(nProgram, "Position_b");
-	GLuint v4Color = glGetAttribLocation(nProgram, "Color_b");
-
-	GLuint CameraPosition = glGetUniformLocation(nProgram, "CameraPosition");
-
-	GLuint gl_nInstances = glGetUniformLocation(nProgram, "nElements");
-
-	GLuint m4ToWorld = glGetUniformLocation(nProgram, "m4ToWorld");
-
-	//ToWorld matrix
-	glUniformMatrix4fv(m4ModelToWorld, 1, GL_FALSE, glm::value_ptr(matrix4(1.0f)));
+	glUseProgram(m_nProgram);
 
-	//Final Projection of the Camera
-	glUniformMatrix4fv(MVP, 1, GL_FALSE, glm::value_ptr(m_pCamera->GetVP()));
+	//Final Projection of the Camera (uniform locations were cached in Init)
+	glUniformMatrix4fv(m_MVP, 1, GL_FALSE, glm::value_ptr(m_pCamera->GetVP()));
 
-	glUniform1i(gl_nInstances, a_nInstances);
-	glUniformMatrix4fv(m4ToWorld, a_nInstances, GL_FALSE, a_fMatrixArray);
+	//AABB the compressed positions were quantized in
+	if (m_bCompressed)
+	{
+		glUniform3f(m_QuantOffset, m_v3QuantOffset.x, m_v3QuantOffset.y, m_v3QuantOffset.z);
+		glUniform3f(m_QuantScale, m_v3QuantScale.x, m_v3QuantScale.y, m_v3QuantScale.z);
+	}
 
-	glUniform3f(CameraPosition, m_pCamera->GetPosition().x, m_pCamera->GetPosition().y, m_pCamera->GetPosition().z);
+	//Vertex layout was recorded in the VAO at compile time
+	glBindVertexArray(m_vao);
 
-	//position
-	glEnableVertexAttribArray(v4Position);
-	glBindBuffer(GL_ARRAY_BUFFER, m_VertexBuffer);
-	glVertexAttribPointer(v4Position, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
+	//The shader can only hold m_nMaxInstances matrices, upload and draw the list in batches of that size
+	for (int nFirst = 0; nFirst < a_nInstances; nFirst += m_nMaxInstances)
+	{
+		int nBatch = a_nInstances - nFirst;
+		if (nBatch > m_nMaxInstances)
+			nBatch = m_nMaxInstances;
 
-	//Color
-	glEnableVertexAttribArray(v4Color);
-	glBindBuffer(GL_ARRAY_BUFFER, m_ColorBuffer);
-	glVertexAttribPointer(v4Color, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
+		//Per object data
+		glUniform1i(m_Elements, nBatch);
+		glUniformMatrix4fv(m_ToWorld, nBatch, GL_FALSE, &a_fMatrixArray[nFirst * 16]);
 
-	glDrawArraysInstanced(GL_TRIANGLES, 0, m_nVertexCount, a_nInstances);
+		glDrawElementsInstanced(GL_TRIANGLES, static_cast<int>(m_lIndex.size()), GL_UNSIGNED_INT, (void*)0, nBatch);
+	}
 
-	glDisableVertexAttribArray(v4Position);
-	glDisableVertexAttribArray(v4Color);
+	glBindVertexArray(0);
 }
 void MyMesh::Render(matrix4 a_mToWorld)
 {
@@ -173,30 +502,20 @@ void MyMesh::Render(matrix4 a_mToWorld)
 		return;
 
 	// Use the buffer and shader
-	GLuint nProgram = m_pShaderMngr->GetShaderID("BasicColor");
-	glUseProgram(nProgram);
+	glUseProgram(m_nProgram);
 
-	// Get the GPU variables by their name and hook them to CPU variables
-	GLuint MVP = glGetUniformLocation(nProgram, "MVP");
-	GLuint v4Position = glGetAttribLocation(nProgram, "Position_b");
-	GLuint v4Color = glGetAttribLocation(nProgram, "Color_b");
-	
-	//Final Projection of the Camera
-	glUniformMatrix4fv(MVP, 1, GL_FALSE, glm::value_ptr(m_pCamera->GetMVP(a_mToWorld)));
+	//Final Projection of the Camera (uniform locations were cached in Init)
+	glUniformMatrix4fv(m_MVP, 1, GL_FALSE, glm::value_ptr(m_pCamera->GetMVP(a_mToWorld)));
 
-	//position
-	glEnableVertexAttribArray(v4Position);
-	glBindBuffer(GL_ARRAY_BUFFER, m_VertexBuffer);
-	glVertexAttribPointer(v4Position, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-	//Color
-	glEnableVertexAttribArray(v4Color);
-	glBindBuffer(GL_ARRAY_BUFFER, m_ColorBuffer);
-	glVertexAttribPointer(v4Color, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
+	//AABB the compressed positions were quantized in
+	if (m_bCompressed)
+	{
+		glUniform3f(m_QuantOffset, m_v3QuantOffset.x, m_v3QuantOffset.y, m_v3QuantOffset.z);
+		glUniform3f(m_QuantScale, m_v3QuantScale.x, m_v3QuantScale.y, m_v3QuantScale.z);
+	}
 
 	//Color and draw
-	glDrawArrays(GL_TRIANGLES, 0, m_nVertexCount);
-
-	glDisableVertexAttribArray(v4Position);
-	glDisableVertexAttribArray(v4Color);
+	glBindVertexArray(m_vao);
+	glDrawElements(GL_TRIANGLES, static_cast<int>(m_lIndex.size()), GL_UNSIGNED_INT, (void*)0);
+	glBindVertexArray(0);
 }
\ No newline at end of file
@@ -22,18 +22,38 @@ using namespace ReEng;
 class MyMesh
 {
 protected:
+	static const int m_nMaxInstances = 250; //Size of the m4ToWorld array in BasicColor.vs
+	static const int m_nCacheSize = 16; //Entries of the post transform vertex cache the index order is optimized for
+
 	bool m_bBinded = false; //Binded flag
+	bool m_bCompressed = false; //Compressed vertex layout flag (16 bit positions and byte colors)
 	int m_nVertexCount = 0; //Number of Vertices in this Mesh
+	int m_nUploadedCount = 0; //Number of welded Vertices sent to the GPU
 
 	GLuint m_vao = 0;			//OpenGL Vertex Array Object
 	GLuint m_VertexBuffer = 0;	//OpenGL Buffer (Will hold the vertex buffer pointer)
 	GLuint m_ColorBuffer = 0;	//OpenGL Buffer (Will hold the color buffer pointer)
+	GLuint m_IndexBuffer = 0;	//OpenGL Buffer (Will hold the index buffer pointer)
+
+	GLuint m_nProgram = 0;	//OpenGL identifier of the shader program for the vertex layout (BasicColor or BasicColorQ)
+	GLuint m_MVP = 0;		//Location of the MVP uniform in the shader
+	GLuint m_Elements = 0;	//Location of the nElements uniform in the shader
+	GLuint m_ToWorld = 0;	//Location of the m4ToWorld uniform array in the shader
+	GLuint m_QuantOffset = 0;	//Location of the v3QuantOffset uniform in BasicColorQ
+	GLuint m_QuantScale = 0;	//Location of the v3QuantScale uniform in BasicColorQ
 
 	CameraSingleton* m_pCamera = nullptr;				//Pointer to the singleton of CameraSingleton
 	ShaderManagerSingleton* m_pShaderMngr = nullptr;	//Shader Manager
 
 	std::vector<vector3> m_lVertexPos;	//List of Vertices
 	std::vector<vector3> m_lVertexCol;	//List of Colors
+	std::vector<GLuint> m_lIndex;		//List of Indices into the welded vertices sent to the GPU
+
+	vector2 m_v2ACMR;	//Average cache miss ratio of the original (x) and optimized (y) triangle order
+	vector2 m_v2VertexBytes;	//Bytes per vertex of the float layout (x) and of the uploaded layout (y)
+
+	vector3 m_v3QuantOffset;	//Minimum corner of the AABB the compressed positions are quantized in
+	vector3 m_v3QuantScale;		//Size of the AABB the compressed positions are quantized in
 
 public:
 	/* Constructor */
@@ -51,16 +71,28 @@ public:
 	/* Compiles the Mesh for OpenGL 3.X use*/
 	void CompileOpenGL3X(void);
 
+	/* Uses the compressed vertex layout (16 bit positions in the mesh AABB, byte colors, drawn with BasicColorQ), call before compiling */
+	void SetCompressed(bool a_bCompressed);
+
 	/* Returns the total number of vertices in this Mesh */
 	int GetVertexTotal(void);
 
+	/* Returns the average cache miss ratio of the original (x) and optimized (y) triangle order, available after compiling */
+	vector2 GetACMR(void);
+
+	/* Returns the number of welded vertices sent to the GPU, available after compiling */
+	int GetUploadedTotal(void);
+
+	/* Returns the bytes per vertex of the float layout (x) and of the uploaded layout (y), available after compiling */
+	vector2 GetVertexBytes(void);
+
 	/* Adds a new point to the vector of vertices */
 	void AddVertexPosition(vector3 a_v3Input);
 
 	/* Adds a new color to the vector of vertices */
 	void AddVertexColor(vector3 a_v3Input);
 
-	/* Renders the shape */
+	/* Renders the shape once per matrix in a contiguous array of 16 floats per instance */
 	virtual void RenderList(float* a_fMatrixArray, int a_nInstances);
 
 	/* Renders the shape asking for its position in the world and a color */
@@ -71,8 +103,16 @@ protected:
 	virtual void Init(void);
 	/* Releases the object from memory */
 	virtual void Release(void);
+	/* Compiles the shader program of the current vertex layout if needed and caches its uniform locations */
+	void LoadProgram(void);
 	/* Completes the information missing to create the mesh */
 	void CompleteMesh(void);
+	/* Welds repeated vertices and builds a cache optimized index list, outputs the vertices in the order the indices first use them */
+	void IndexMesh(std::vector<vector3>& a_lPosition, std::vector<vector3>& a_lColor);
+	/* Reorders the triangles in the index list for post transform cache locality (Tipsify) */
+	void OptimizeVertexCache(int a_nVertices);
+	/* Returns the average number of vertices transformed per triangle of the index list through a FIFO cache */
+	float CalculateACMR(void);
 
 public:
 	/* Completes the triangle information */
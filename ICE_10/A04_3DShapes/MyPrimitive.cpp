@@ -7,21 +7,29 @@ void MyPrimitive::Release(void)
 {
 	super::Release();
 
-	if (m_ColorBuffer2 > 0)
-		glDeleteBuffers(1, &m_ColorBuffer2);
+	if (m_LineBuffer > 0)
+		glDeleteBuffers(1, &m_LineBuffer);
 
-	if (m_VertexBuffer2 > 0)
-		glDeleteBuffers(1, &m_VertexBuffer2);
+	if (m_vao2 > 0)
+		glDeleteVertexArrays(1, &m_vao2);
 
-	m_lVertexPos2.clear();
-	m_lVertexCol2.clear();
+	m_lLineVertex.clear();
 }
 void MyPrimitive::Init(void)
 {
 	super::Init();
 
-	m_VertexBuffer2 = 0;
-	m_ColorBuffer2 = 0;
+	m_vao2 = 0;
+	m_LineBuffer = 0;
+
+	//The line vertices are not compressed, draw them with BasicColor whatever layout the faces use
+	if (m_pShaderMngr->IdentifyShader("BasicColor") < 0)
+	{
+		FolderSingleton* pFolder = FolderSingleton::GetInstance();
+		m_pShaderMngr->CompileShader(pFolder->GetFolderShaders() + "BasicColor.vs", pFolder->GetFolderShaders() + "BasicColor.fs", "BasicColor");
+	}
+	m_nLineProgram = m_pShaderMngr->GetShaderID("BasicColor");
+	m_LineMVP = glGetUniformLocation(m_nLineProgram, "MVP");
 }
 void MyPrimitive::CompileObject(vector3 a_vColor)
 {
@@ -30,33 +38,47 @@ void MyPrimitive::CompileObject(vector3 a_vColor)
 	for (int nColor = nColorTotal; nColor < m_nVertexCount; nColor++)
 		m_lVertexCol.push_back(a_vColor);
 	CompileOpenGL3X();
-	//Compile Lines
+	//Compile Lines, three edges per triangle with the position and color of each end next to each other
+	vector3 v3LineColor(1.0f - a_vColor.x, 1.0f - a_vColor.y, 1.0f - a_vColor.z);
+	m_lLineVertex.reserve(m_nVertexCount * 4);
 	for (int i = 0; i < m_nVertexCount - 2; i += 3)
 	{
-		m_lVertexPos2.push_back(m_lVertexPos[i]);
-		m_lVertexPos2.push_back(m_lVertexPos[i + 1]);
-
-		m_lVertexPos2.push_back(m_lVertexPos[i + 1]);
-		m_lVertexPos2.push_back(m_lVertexPos[i + 2]);
-		
-		m_lVertexPos2.push_back(m_lVertexPos[i + 2]);
-		m_lVertexPos2.push_back(m_lVertexPos[i]);
-	}
-	int nVertices = m_lVertexPos2.size();
-	for (int nVertex = 0; nVertex < nVertices; nVertex++)
-	{
-		m_lVertexCol2.push_back(vector3(1.0f - a_vColor.x, 1.0f - a_vColor.y, 1.0f - a_vColor.z));
+		for (int nEdge = 0; nEdge < 3; nEdge++)
+		{
+			m_lLineVertex.push_back(m_lVertexPos[i + nEdge]);
+			m_lLineVertex.push_back(v3LineColor);
+			m_lLineVertex.push_back(m_lVertexPos[i + (nEdge + 1) % 3]);
+			m_lLineVertex.push_back(v3LineColor);
+		}
 	}
+	//Nothing to upload if the faces were not compiled or there are no full triangles
+	if (!m_bBinded || m_lLineVertex.empty())
+		return;
 
-	// Create and initialize a buffer object for each shape.
-	glGenBuffers(1, &m_VertexBuffer2);
-	glBindBuffer(GL_ARRAY_BUFFER, m_VertexBuffer2);
-	glBufferData(GL_ARRAY_BUFFER, nVertices * sizeof(vector3), &m_lVertexPos2[0], GL_STATIC_DRAW);
+	int nVertices = static_cast<int>(m_lLineVertex.size()) / 2;
+
+	// Create a vertex array object for the lines
+	glGenVertexArrays(1, &m_vao2);
+	glBindVertexArray(m_vao2);
+
+	// Create and initialize a single buffer holding both attributes, uploaded in one call
+	glGenBuffers(1, &m_LineBuffer);
+	glBindBuffer(GL_ARRAY_BUFFER, m_LineBuffer);
+	glBufferData(GL_ARRAY_BUFFER, nVertices * 2 * sizeof(vector3), &m_lLineVertex[0], GL_STATIC_DRAW);
+
+	//Record the vertex layout in the VAO so drawing only needs to bind it
+	GLuint v4Position = glGetAttribLocation(m_nLineProgram, "Position_b");
+	GLuint v4Color = glGetAttribLocation(m_nLineProgram, "Color_b");
+
+	//position
+	glEnableVertexAttribArray(v4Position);
+	glVertexAttribPointer(v4Position, 3, GL_FLOAT, GL_FALSE, 2 * sizeof(vector3), (void*)0);
 
-	//Initialize the color buffer for the object.
-	glGenBuffers(1, &m_ColorBuffer2);
-	glBindBuffer(GL_ARRAY_BUFFER, m_ColorBuffer2);
-	glBufferData(GL_ARRAY_BUFFER, nVertices * sizeof(vector3), &m_lVertexCol2[0], GL_STATIC_DRAW);
+	//Color
+	glEnableVertexAttribArray(v4Color);
+	glVertexAttribPointer(v4Color, 3, GL_FLOAT, GL_FALSE, 2 * sizeof(vector3), (void*)sizeof(vector3));
+
+	glBindVertexArray(0);
 }
 void MyPrimitive::Render(matrix4 a_mToWorld)
 {
@@ -70,30 +92,13 @@ void MyPrimitive::Render(matrix4 a_mToWorld)
 		return;
 
 	// Use the buffer and shader
-	GLuint nProgram = m_pShaderMngr->GetShaderID("BasicColor");
-	glUseProgram(nProgram);
+	glUseProgram(m_nLineProgram);
 
-	// Get the GPU variables by their name and hook them to CPU variables
-	GLuint MVP = glGetUniformLocation(nProgram, "MVP");
-	GLuint v4Position = glGetAttribLocation(nProgram, "Position_b");
-	GLuint v4Color = glGetAttribLocation(nProgram, "Color_b");
-
-	//Final Projection of the Camera
-	glUniformMatrix4fv(MVP, 1, GL_FALSE, glm::value_ptr(m_pCamera->GetMVP(a_mToWorld)));
-
-	//position
-	glEnableVertexAttribArray(v4Position);
-	glBindBuffer(GL_ARRAY_BUFFER, m_VertexBuffer2);
-	glVertexAttribPointer(v4Position, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
-
-	//Color
-	glEnableVertexAttribArray(v4Color);
-	glBindBuffer(GL_ARRAY_BUFFER, m_ColorBuffer2);
-	glVertexAttribPointer(v4Color, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
+	//Final Projection of the Camera (uniform locations were cached in Init)
+	glUniformMatrix4fv(m_LineMVP, 1, GL_FALSE, glm::value_ptr(m_pCamera->GetMVP(a_mToWorld)));
 
 	//Color and draw
-	glDrawArrays(GL_LINES, 0, static_cast<int>(m_lVertexPos2.size()));
-
-	glDisableVertexAttribArray(v4Position);
-	glDisableVertexAttribArray(v4Color);
+	glBindVertexArray(m_vao2);
+	glDrawArrays(GL_LINES, 0, static_cast<int>(m_lLineVertex.size()) / 2);
+	glBindVertexArray(0);
 }
\ No newline at end of file
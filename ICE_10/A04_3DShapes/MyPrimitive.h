@@ -12,11 +12,12 @@ class MyPrimitive : public MyMesh
 {
 	typedef MyMesh super;
 
-	GLuint m_VertexBuffer2 = 0; //for lines
-	GLuint m_ColorBuffer2 = 0; //for lines
+	GLuint m_vao2 = 0; //for lines
+	GLuint m_nLineProgram = 0; //for lines, always BasicColor as the line vertices are floats
+	GLuint m_LineMVP = 0; //for lines, location of the MVP uniform
+	GLuint m_LineBuffer = 0; //for lines, position and color interleaved
 
-	std::vector<vector3> m_lVertexPos2;	//List of Vertices
-	std::vector<vector3> m_lVertexCol2;	//List of Colors
+	std::vector<vector3> m_lLineVertex;	//List of line vertices, each position followed by its color
 
 public:
 	/* Constructor */
@@ -14,6 +14,7 @@ void AppClass::InitUserVariables(void)
 
 	//Loads the character
 	m_pMeshMngr->LoadModel("Sorted\\WallEye.obj", "WallEye");
+	m_nWallEye = m_pMeshMngr->IdentifyInstance("WallEye"); //look the name up once
 }
 
 void AppClass::Update(void)
@@ -32,7 +33,8 @@ void AppClass::Update(void)
 	fRunTime += fTimeSpan;
 
 	//example
-	m_pMeshMngr->SetModelMatrix(glm::translate(vector3(0.0f)), "WallEye"); //set the model's position
+	if (m_nWallEye >= 0) //-1 would move every instance
+		m_pMeshMngr->SetModelMatrix(glm::translate(vector3(0.0f)), m_nWallEye); //set the model's position
 	m_pMeshMngr->AddSphereToQueue(glm::translate(vector3(1.0f)) * glm::scale(vector3(0.1f)), RERED, SOLID); //render a sphere
 	printf("\rfTimeSpan: %.3f, fRunSpan: %.3f, fDuration: %.3f                 ", fTimeSpan, fRunTime, fDuration); //prints out the information
 
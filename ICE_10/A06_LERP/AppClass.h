@@ -14,6 +14,7 @@ using namespace ReEng; //Using ReEng namespace to use all the classes in the dll
 class AppClass : public ReEngAppClass
 {
 	float fDuration = 1.0f;
+	int m_nWallEye = -1; //index of the WallEye instance in the Mesh Manager
 
 	std::vector<vector3> m_lPositions; //list of Stops.
 
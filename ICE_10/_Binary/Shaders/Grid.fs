@@ -0,0 +1,56 @@
+#version 330
+
+in vec3 NearPoint;
+in vec3 FarPoint;
+
+uniform mat4 VP;
+uniform vec3 CameraPosition;
+uniform int nPlane; //0 = XY, 1 = XZ, 2 = YZ
+uniform float fScale; //distance between lines
+uniform float fFadeDistance; //distance at which the grid disappears
+
+out vec4 Fragment;
+
+//Returns 1 on a line and 0 away from it, the width is one pixel thanks to the screen space derivatives
+float GridLine(vec2 v2Coord)
+{
+	vec2 v2Distance = abs(fract(v2Coord - 0.5) - 0.5) / fwidth(v2Coord);
+	return 1.0 - min(min(v2Distance.x, v2Distance.y), 1.0);
+}
+
+void main()
+{
+	//Component of the normal of the plane and the two components that lay on it
+	vec3 v3Near = nPlane == 0 ? NearPoint.xyz : (nPlane == 1 ? NearPoint.xzy : NearPoint.yzx);
+	vec3 v3Far = nPlane == 0 ? FarPoint.xyz : (nPlane == 1 ? FarPoint.xzy : FarPoint.yzx);
+
+	//Intersect the view ray with the plane
+	float fT = -v3Near.z / (v3Far.z - v3Near.z);
+	vec3 v3Position = NearPoint + fT * (FarPoint - NearPoint);
+	vec2 v2Coord = v3Near.xy + fT * (v3Far.xy - v3Near.xy);
+
+	//Write the depth of the plane so the grid is hidden by the geometry in front of it
+	vec4 v4Clip = VP * vec4(v3Position, 1.0);
+	gl_FragDepth = (v4Clip.z / v4Clip.w) * 0.5 + 0.5;
+
+	float fMinor = GridLine(v2Coord / fScale);
+	float fMajor = GridLine(v2Coord / (fScale * 10.0));
+	float fFade = 1.0 - clamp(distance(CameraPosition, v3Position) / fFadeDistance, 0.0, 1.0);
+
+	//Lines through the origin are drawn in the color of the axis they represent
+	vec2 v2Axis = abs(v2Coord) / fwidth(v2Coord);
+	vec3 v3AxisU = nPlane == 2 ? vec3(0.0, 1.0, 0.0) : vec3(1.0, 0.0, 0.0);
+	vec3 v3AxisV = nPlane == 0 ? vec3(0.0, 1.0, 0.0) : vec3(0.0, 0.0, 1.0);
+	vec3 v3Color = mix(vec3(0.5), vec3(0.8), fMajor);
+	if (v2Axis.y < 1.0)
+		v3Color = v3AxisU;
+	else if (v2Axis.x < 1.0)
+		v3Color = v3AxisV;
+
+	//Discard after the derivatives are taken, when the ray misses the plane between near and far or the line fades out
+	float fAlpha = max(fMinor * 0.5, fMajor) * fFade;
+	if (fT <= 0.0 || fT > 1.0 || fAlpha <= 0.0)
+		discard;
+
+	Fragment = vec4(v3Color, fAlpha);
+}
\ No newline at end of file
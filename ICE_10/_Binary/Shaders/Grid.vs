@@ -0,0 +1,20 @@
+#version 330
+
+uniform mat4 m4InverseVP;
+
+out vec3 NearPoint;
+out vec3 FarPoint;
+
+void main()
+{
+	//Full screen triangle made out of the vertex index, no vertex data is needed
+	vec2 v2Screen = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2) * 2.0 - 1.0;
+
+	//Unproject the pixel to the near and far planes so the fragment can build its view ray
+	vec4 v4Near = m4InverseVP * vec4(v2Screen, -1.0, 1.0);
+	vec4 v4Far = m4InverseVP * vec4(v2Screen, 1.0, 1.0);
+	NearPoint = v4Near.xyz / v4Near.w;
+	FarPoint = v4Far.xyz / v4Far.w;
+
+	gl_Position = vec4(v2Screen, 0.0, 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#version 330
+
+in vec3 Position_b;
+in vec3 Color_b;
+
+uniform mat4 MVP;
+uniform int nElements;
+uniform mat4 m4ToWorld[250];
+
+//The position arrives as a normalized 16 bit value inside the mesh AABB
+uniform vec3 v3QuantOffset;
+uniform vec3 v3QuantScale;
+
+out vec3 Color;
+
+void main()
+{
+	vec4 v4Position = vec4(v3QuantOffset + Position_b * v3QuantScale, 1);
+
+	if( nElements < 1 )
+	{
+		gl_Position = MVP * v4Position;
+	}
+	else
+	{
+		gl_Position = (MVP * m4ToWorld[gl_InstanceID]) * v4Position;
+	}
+	
+	Color = Color_b;
+}
\ No newline at end of file